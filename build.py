@@ -4,54 +4,212 @@ build_folder = "build_dir"
 
 resources = [
     "libs/*",
-    "license/*",
-    "resources/*"
+    "license/*"
+]
+
+# asset packs (output filename: resources), each one is a single packed resource with a sorted table of contents,
+# read by SDL2::AssetPack right from the executable (good for many small files like sprites and sounds)
+asset_packs = {
+    "resources.pack": [
+        "resources/*"
+    ]
+}
+
+# images of the asset packs which are decoded at the build time (needs Pillow): they are packed as "<name>.pixels" instead,
+# raw pixels read by SDL2::SurfaceFromPixels without decoding (the original files are packed if Pillow isn't installed)
+baked_images = [
+    "resources/*.png",
+    "resources/*.ico"
+]
+
+# compression of the packed resources (pattern of the path: method), the first matching pattern is used
+# store - for compressed already files (images, sounds) and libraries: they are unpacked by a plain copy and read by SDL2::RWFromZip right from the executable
+# deflate - for everything else, like text licenses
+compression_rules = [
+    ("*.png", "store"),
+    ("*.jpg", "store"),
+    ("*.webp", "store"),
+    ("*.ogg", "store"),
+    ("*.opus", "store"),
+    ("*.dll", "store"),
+    ("*.so", "store"),
+    ("*.pack", "store"),
+    ("*", "deflate")
 ]
 
-output_filename = "sdltest.exe"
 
 include_folders = [
     "include",
+    "sources",
     "/usr/include/SDL2",
     "/usr/include/x86_64-linux-gnu/SDL2"
 ]
 
-sources = [
-    "sources/application.cpp",
-    "sources/cosmo_sdl2.cpp"
-]
+# preprocessor definitions, e.g. "COSMO_SDL2_PROFILE" (per-function call counters and latency histograms, printed at SDL2::Quit)
+defines = []
+
+# output filename: sources
+targets = {
+    "sdltest.exe": [
+        "sources/application.cpp",
+        "sources/cosmo_sdl2.cpp"
+    ],
+    "sdlbench.exe": [
+        "sources/benchmark.cpp",
+        "sources/cosmo_sdl2.cpp"
+    ]
+}
+
+# output filename: preprocessor definitions of the target only
+# (COSMO_SDL2_SUBSET compiles only the SDL2 functions enabled in the named header, see cosmo_sdl2.hpp)
+target_defines = {
+    "sdltest.exe": ['COSMO_SDL2_SUBSET="application_sdl2.h"']
+}
+
+# count of zipobj and compiler processes started at once (None - depending on the count of processors)
+jobs = None
 
 # IMPLEMENTATION
 
-from subprocess import Popen
-from os.path import isdir, isfile, exists, split
-from os import mkdir, listdir
-from shutil import rmtree, which
-from random import randint
+from subprocess import run
+from os.path import isdir, isfile, exists, split, abspath, join
+from os import makedirs, listdir, remove
+from shutil import which
+from shlex import quote
+from fnmatch import fnmatch
+from glob import glob
+from struct import pack
+from hashlib import sha256
+from importlib.util import find_spec
+from urllib.parse import quote as quote_url
+from concurrent.futures import ThreadPoolExecutor
+
+def compression_options(path):
+    global compression_rules
+    for pattern, method in compression_rules:
+        if fnmatch(path, pattern):
+            if method not in ("store", "deflate"):
+                raise Exception(f"Unknown compression method '{method}' for {pattern}.")
+            return "-0 " if method == "store" else ""
+    return ""
+
+def call(params):
+    print(f"Call {params}")
+    if run(["sh", "-c", params]).returncode != 0:
+        raise Exception(f"Failed: {params}")
 
-def pack_resource(path):
+def file_hash(path):
+    result = sha256()
+    with open(path, "rb") as file:
+        while chunk := file.read(1 << 20):
+            result.update(chunk)
+    return result.hexdigest()
+
+def pack_resource(path, executor, folder="."):
+    # folder - the folder the path is relative to, the resource gets the path as its name in the package
     global build_folder
     resource_path, resource = split(path)
     if resource == "*":
-        return [pack_resource(f"{resource_path}/{x}") for x in listdir(resource_path)]
-    index = randint(0, 999999)
-    zip_name = f"{'0' * (6-len(str(index)))}{index}{resource}.zip.o"
+        return [pack_resource(join(resource_path, x), executor, folder) for x in sorted(listdir(join(folder, resource_path))) if x != ".aarch64"]
     if exists(f"{build_folder}/.aarch64"):
         if not isdir(f"{build_folder}/.aarch64"):
             raise Exception(f"Path {build_folder}/.aarch64 exists already, but is not a folder.")
     else:
-        mkdir(f"{build_folder}/.aarch64")
+        makedirs(f"{build_folder}/.aarch64")
+    zip_name = quote_url(path, safe="") + ".zip.o" # the same for the same resource, so it can be reused (and different for different ones)
+    options = compression_options(path)
+    aarch64_resource = path # x86_64 and aarch64 resources are the same by default
+    if isfile(join(folder, resource_path, ".aarch64", resource)):
+        aarch64_resource = join(resource_path, ".aarch64", resource)
+    # the resources are packed again only if their content, the options or the aarch64 variant changed
+    stamp = f"{options}{file_hash(join(folder, path))} {aarch64_resource} {file_hash(join(folder, aarch64_resource))}\n"
+    stamp_path = f"{build_folder}/{zip_name}.hash"
+    if isfile(f"{build_folder}/{zip_name}") and isfile(f"{build_folder}/.aarch64/{zip_name}") and isfile(stamp_path):
+        with open(stamp_path) as file:
+            if file.read() == stamp:
+                print(f"Skip {path} (not changed)")
+                return [zip_name]
+    if isfile(stamp_path):
+        remove(stamp_path)
     zipobj = which("zipobj")
-    params = zipobj + f" -o {build_folder}/{zip_name} {resource_path}/{resource}"
-    print(f"Call {params}")
-    Popen(["sh", "-c", params]).wait()
-    aarch64_resource = f"{resource_path}/{resource}" # x86_64 and aarch64 resources are the same by default
-    if isdir(f"{resource_path}/.aarch64") and isfile(f"{resource_path}/.aarch64/{resource}"):
-        aarch64_resource = f"{resource_path}/.aarch64/{resource}"
-    params = zipobj + f" -a aarch64 -o {build_folder}/.aarch64/{zip_name} {aarch64_resource}"
-    print(f"Call {params}")
-    Popen(["sh", "-c", params]).wait()
-    return [zip_name]
+    output = abspath(build_folder)
+    def pack():
+        call(f"cd {quote(folder)} && {zipobj} {options}-o {output}/{zip_name} {path}")
+        call(f"cd {quote(folder)} && {zipobj} {options}-a aarch64 -o {output}/.aarch64/{zip_name} {aarch64_resource}")
+        with open(stamp_path, "w") as file:
+            file.write(stamp)
+    return [(zip_name, executor.submit(pack))]
+
+def asset_hash(name):
+    # FNV-1a (64 bits) of the name, the same as Fnv1a in cosmo_sdl2.cpp (used by SDL2::AssetPack)
+    result = 14695981039346656037
+    for byte in name.encode():
+        result = ((result ^ byte) * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return result
+
+def bake_image(path):
+    # format (little endian): "CSDL2PIX", uint32 SDL pixel format (SDL_PIXELFORMAT_ARGB8888), uint32 width, uint32 height, uint32 pitch,
+    # then the rows of the pixels from the offset 64
+    try:
+        from PIL import Image
+    except ImportError:
+        return None
+    with Image.open(path) as image:
+        image = image.convert("RGBA")
+        header = b"CSDL2PIX" + pack("<IIII", 0x16362004, image.width, image.height, image.width * 4)
+        return header + b"\0" * (64 - len(header)) + image.tobytes("raw", "BGRA")
+
+def build_asset_pack(pack_name, patterns):
+    # format (little endian): "CSDL2PAK", uint32 version (1), uint32 count of assets,
+    # assets sorted by (hash, name): uint64 hash, uint64 offset, uint64 size, uint32 name offset, uint32 name length,
+    # names, then the data of every asset aligned to 64 bytes (offsets are from the start of the pack)
+    global build_folder
+    global baked_images
+    files = sorted({x for pattern in patterns for x in glob(pattern) if isfile(x)})
+    can_bake = find_spec("PIL") is not None
+    baked = {x for x in files if can_bake and any(fnmatch(x, pattern) for pattern in baked_images)}
+    # the pack is built again only if the files, their content or which of them are baked changed (baking decodes every image)
+    stamp = "".join(f"{x} {file_hash(x)}{' baked' if x in baked else ''}\n" for x in files)
+    path = f"{build_folder}/{pack_name}"
+    stamp_path = f"{path}.hash"
+    if isfile(path) and isfile(stamp_path):
+        with open(stamp_path) as file:
+            if file.read() == stamp:
+                print(f"Skip {pack_name} (not changed)")
+                return
+    if isfile(stamp_path):
+        remove(stamp_path)
+    assets = {}
+    for x in files:
+        if x in baked and (pixels := bake_image(x)) is not None:
+            assets[f"{x}.pixels"] = pixels
+        else:
+            with open(x, "rb") as file:
+                assets[x] = file.read()
+    names = sorted(assets, key=lambda x: (asset_hash(x), x.encode()))
+    table_size = 16 + 32 * len(names)
+    names_data = b"".join(x.encode() for x in names)
+    offset = table_size + len(names_data)
+    table, blobs, name_offset = [], [], table_size
+    for name in names:
+        data = assets[name]
+        padding = -offset % 64
+        blobs.append(b"\0" * padding + data)
+        offset += padding
+        table.append(pack("<QQQII", asset_hash(name), offset, len(data), name_offset, len(name.encode())))
+        offset += len(data)
+        name_offset += len(name.encode())
+    content = b"CSDL2PAK" + pack("<II", 1, len(names)) + b"".join(table) + names_data + b"".join(blobs)
+    written = True
+    if isfile(path): # not written again if it's the same, so it isn't packed again
+        with open(path, "rb") as file:
+            written = file.read() != content
+    if written:
+        print(f"Build {pack_name} ({len(names)} assets)")
+        with open(path, "wb") as file:
+            file.write(content)
+    with open(stamp_path, "w") as file:
+        file.write(stamp)
 
 def flatten_list(l):
     result = []
@@ -60,19 +218,37 @@ def flatten_list(l):
         else: result.append(x)
     return result
 
-def start_compiler(packed_resources):
+def remove_stale_resources(packed_resources):
+    global build_folder
+    for folder in (build_folder, f"{build_folder}/.aarch64"):
+        for x in listdir(folder):
+            if (x.endswith(".zip.o") and x not in packed_resources) or (x.endswith(".zip.o.hash") and x[:-len(".hash")] not in packed_resources):
+                remove(f"{folder}/{x}")
+
+def start_compiler(packed_resources, output_filename, sources):
     global build_folder
-    global output_filename
     global include_folders
-    global sources
-    includes = [f"-I {x}" for x in include_folders]
+    global defines
+    global target_defines
+    includes = [f"-I {x}" for x in include_folders] + [quote(f"-D{x}") for x in defines + target_defines.get(output_filename, [])]
     resources = [f"-s {build_folder}/{x}" for x in packed_resources]
     cosmocpp = f'{which("cosmoc++")} -std=c++20 {" ".join(includes)} {" ".join(resources)} -o {build_folder}/{output_filename} {" ".join(sources)}'
-    print(f"Call {cosmocpp}")
-    print("-" * 80)
-    Popen(["sh", "-c", cosmocpp]).wait()
-
-if exists(build_folder):
-    rmtree(build_folder)
-mkdir(build_folder)
-start_compiler(flatten_list([pack_resource(r) for r in resources]))
+    call(cosmocpp)
+
+makedirs(build_folder, exist_ok=True)
+with ThreadPoolExecutor(max_workers=jobs) as executor:
+    for pack_name, patterns in asset_packs.items():
+        build_asset_pack(pack_name, patterns)
+    packed_resources = []
+    packs = [pack_resource(x, executor, build_folder) for x in asset_packs]
+    for x in flatten_list([pack_resource(r, executor) for r in resources] + packs):
+        if type(x) == tuple:
+            x[1].result()
+            x = x[0]
+        if x in packed_resources: # a resource and an asset pack of the same name would go into the same object
+            raise Exception(f"Two resources are packed into {x}.")
+        packed_resources.append(x)
+    remove_stale_resources(packed_resources)
+    compilers = [executor.submit(start_compiler, packed_resources, output_filename, sources) for output_filename, sources in targets.items()]
+    for compiler in compilers:
+        compiler.result()
@@ -10,13 +10,45 @@
 #include <SDL_mixer.h>
 #include <SDL_net.h>
 
+#include <libc/isystem/atomic>
+#include <libc/isystem/chrono>
+#include <libc/isystem/functional>
+#include <libc/isystem/memory>
+#include <libc/isystem/optional>
+#include <libc/isystem/span>
 #include <libc/isystem/string>
+#include <libc/isystem/string_view>
+#include <libc/isystem/thread>
+#include <libc/isystem/vector>
 
 #ifdef COSMO_SDL2_VULKAN
 #include <SDL_vulkan.h>
 #include <vulkan/vulkan.h>
 #endif
 
+/* Subset of the SDL2 functions. If COSMO_SDL2_SUBSET names a header (-DCOSMO_SDL2_SUBSET='"application_sdl2.h"' for example),
+   only the functions it enables are compiled into cosmo_sdl2.cpp and bound, the others aren't defined.
+   The header enables a function with #define COSMO_SDL2_USE_<name> 1, where the name is the wrapper name with the Net, Mix, TTF or IMG
+   prefix for the functions of SDL2::Net, SDL2::Mixer, SDL2::TTF and SDL2::Image (COSMO_SDL2_USE_PollEvent, COSMO_SDL2_USE_IMGLoad). */
+#ifdef COSMO_SDL2_SUBSET
+#include COSMO_SDL2_SUBSET
+#define COSMO_SDL2_ENABLED(name) COSMO_SDL2_ENABLED_VALUE(COSMO_SDL2_USE_##name)
+#else
+#define COSMO_SDL2_ENABLED(name) 1
+#endif
+#define COSMO_SDL2_ENABLED_VALUE(value) COSMO_SDL2_ENABLED_EXPANDED(value)
+#define COSMO_SDL2_ENABLED_EXPANDED(value) COSMO_SDL2_ENABLED_PLACEHOLDER(COSMO_SDL2_PLACEHOLDER_##value)
+#define COSMO_SDL2_PLACEHOLDER_1 0,
+#define COSMO_SDL2_ENABLED_PLACEHOLDER(placeholder_or_junk) COSMO_SDL2_SECOND(placeholder_or_junk 1, 0, ~)
+#define COSMO_SDL2_SECOND(ignored, value, ...) value
+
+/// @brief Expands to the code (the rest of the arguments) only if the function is enabled by the subset (or there is no subset).
+#define COSMO_SDL2_SELECT(name, ...) COSMO_SDL2_WHEN(COSMO_SDL2_ENABLED(name), __VA_ARGS__)
+#define COSMO_SDL2_WHEN(enabled, ...) COSMO_SDL2_WHEN_EXPANDED(enabled, __VA_ARGS__)
+#define COSMO_SDL2_WHEN_EXPANDED(enabled, ...) COSMO_SDL2_WHEN_##enabled(__VA_ARGS__)
+#define COSMO_SDL2_WHEN_0(...)
+#define COSMO_SDL2_WHEN_1(...) __VA_ARGS__
+
 enum class ErrorLevel {
     log,
     info,
@@ -29,17 +61,64 @@ enum class ErrorLevel {
 /// @param level is the level of importance of the error (info, warning, error)
 void LogError(const std::string& error, ErrorLevel level = ErrorLevel::error, std::ostream& out = std::cerr);
 
-/// @brief Unpacks a file from the ZIP archive inside the application.
+/// @brief Unpacks a file from the ZIP archive inside the application. The file isn't written if it's unpacked already
+/// (the existing file has the same size and CRC-32 as in the archive). An unpacked file gets the modification time of its entry,
+/// the CRC-32 is computed only if the time differs.
 /// @param filename path and name of the file inside the archive
-/// @return True if unpacked successfully and False otherwise
+/// @return True if unpacked successfully (or unpacked already) and False otherwise
 bool UnpackFile(const std::string& filename, bool do_log = true);
 
+/// @brief Unpacks files from the ZIP archive inside the application like UnpackFile, but concurrently on a few threads.
+/// @param filenames paths and names of the files inside the archive
+/// @return For every file, True if unpacked successfully (or unpacked already) and False otherwise
+std::vector<bool> UnpackFiles(const std::vector<std::string>& filenames, bool do_log = true);
+
+/// @brief Unpacks files from the ZIP archive inside the application into the per-user cache (COSMO_SDL2_CACHE, $XDG_CACHE_HOME/cosmo_sdl2,
+/// ~/.cache/cosmo_sdl2 or %LOCALAPPDATA%/cosmo_sdl2), into a folder named after their content. So all the instances and versions of the
+/// applications share one copy of the same files. The files are written under temporary names and renamed, so they never appear partially.
+/// @param filenames paths and names of the files inside the archive, they are put together into one folder (a library with its dependencies)
+/// @return The folder with the files (ending with a slash) or nothing if they can't be unpacked there
+std::optional<std::string> UnpackToCache(const std::vector<std::string>& filenames, bool do_log = true);
+
+/// @brief Counters of UnpackFile since the start of the application.
+struct UnpackStatistics {
+    uint64_t unpacked_files;
+    uint64_t unpacked_bytes;
+    uint64_t skipped_files; // Unpacked already, so not written again
+    uint64_t skipped_bytes;
+};
+
+/// @brief Returns how many files (and bytes) UnpackFile wrote and how many it didn't write because they were unpacked already.
+UnpackStatistics GetUnpackStatistics();
+
 namespace SDL2 {
 
     /// @brief Turns off and on logging
     /// @param do_log defines if the library should log or not
     void SwitchLog(bool do_log);
 
+    /// @brief Turns off and on loading the packed libraries from memory on Linux (they are unpacked to the library path otherwise).
+    /// Falls back to unpacking if the system can't load a library from memory.
+    /// @param in_memory defines if the libraries should be loaded from memory or not
+    void SwitchMemoryLoading(bool in_memory);
+
+    /// @brief Turns off and on unpacking the libraries into the per-user cache shared by the applications (see UnpackToCache)
+    /// instead of the library path. Falls back to the library path if the cache can't be used.
+    /// @param shared defines if the libraries should be unpacked into the shared cache or not
+    void SwitchSharedCache(bool shared);
+
+    /// @brief SDL2 satellite libraries, flags for SDL2::Preload
+    enum Libraries : uint32_t {
+        LIB_NET = 0x1,
+        LIB_MIXER = 0x2,
+        LIB_TTF = 0x4,
+        LIB_IMAGE = 0x8
+    };
+
+    /// @brief Requests the libraries to be opened and bound on worker threads while SDL2::Init initializes SDL2 (instead of on their first use).
+    /// @param libraries is a combination of SDL2::Libraries flags (LIB_NET, LIB_MIXER, LIB_TTF, LIB_IMAGE)
+    void Preload(uint32_t libraries);
+
     /// @brief Opens a dynamic library (shared object) using dlopen, and saves the pointer to it if opening was successfull. Otherwise prints an error to the log.
     /// @param libname is the actual name of a library, used only for logging in the case of an error
     /// @param pointer is the variable where the pointer to the library will be stored in the case of successfull loading
@@ -48,11 +127,17 @@ namespace SDL2 {
     /// @return True if the loading was successfull and False otherwise.
     bool OpenRequiredLibrary(const std::string& libname, void*& pointer, std::string filename, const std::string& library_path = "./");
 
-    /// @brief Loads the full SDL package and all supported SDL2 functions.
+    /// @brief Loads the SDL2 library. SDL2 Net, Mixer, TTF and Image libraries are loaded on their first use (their Init functions).
+    /// The functions are looked up lazily, each one on its first call.
     /// @param library_path is not necessary, define the path to the libraries (current by default)
     /// @return True if the lib was loaded correctly and False otherwise.
     bool LoadSDLLibrary(const std::string& library_path = "./");
 
+    /// @brief Looks up all supported SDL2 functions at once instead of on their first calls (useful to check the libraries up front).
+    /// The Linux-only functions are looked up only on Linux.
+    /// @return True if all the functions were found and False otherwise.
+    bool BindAllFunctions();
+
     /// @brief Unloads the SDL library
     void UnloadLibrary();
 
@@ -60,12 +145,186 @@ namespace SDL2 {
     /// @return True if the lib is loaded and False otherwise.
     bool IsLoaded();
 
+    /// @brief Opens a file of the ZIP archive inside the application for reading, without unpacking it to the disk.
+    /// A stored (not compressed) file is read right from the executable mapped to the memory. A compressed one is opened through /zip/,
+    /// and the cosmopolitan libc inflates it whole into the memory when it's opened.
+    /// Use it with the *_RW functions, like SDL2::Image::Load_RW(SDL2::RWFromZip("resources/image.png"), 1).
+    /// @param filename path and name of the file inside the archive
+    /// @return Returns a pointer to the SDL_RWops structure, or NULL on failure.
+    SDL_RWops* RWFromZip(const std::string& filename);
+
+    /// @brief Asset pack made by build.py (asset_packs): a table of contents sorted by the hashes of the asset names, followed by
+    /// the data of the assets aligned to 64 bytes. The pack is mapped to the memory, so an asset is found in O(log n) and read in place,
+    /// without allocations.
+    class AssetPack {
+    public:
+        AssetPack() = default;
+
+        /// @brief Opens a pack. A stored pack of the application ("/zip/resources.pack") is read right from the executable,
+        /// another file is mapped to the memory. If the pack can't be opened, IsOpen returns False (and the error is logged).
+        explicit AssetPack(const std::string& path);
+        ~AssetPack();
+        AssetPack(const AssetPack&) = delete;
+        AssetPack& operator=(const AssetPack&) = delete;
+
+        /// @brief Returns if the pack is opened.
+        bool IsOpen() const { return data != nullptr; }
+
+        /// @brief Returns the count of the assets in the pack.
+        uint32_t Count() const;
+
+        /// @brief Looks an asset up by its name (path relative to the project, like "resources/image.png").
+        /// @return The data of the asset (valid while the pack is opened) or nothing if there is no such asset.
+        std::optional<std::span<const char>> Find(std::string_view name) const;
+
+        /// @brief Opens an asset for the *_RW functions, like SDL2::Image::Load_RW(pack.RWFromAsset("resources/image.png"), 1).
+        /// @return Returns a pointer to the SDL_RWops structure, or NULL if there is no such asset.
+        SDL_RWops* RWFromAsset(std::string_view name) const;
+
+    private:
+        const char* data = nullptr;
+        size_t size = 0;
+        bool mapped = false; // Mapped by the pack (not a part of the mapped executable)
+    };
+
+    /// @brief Wraps pixels baked by build.py (baked_images, packed as "<name>.pixels") into a surface, without decoding or copying them.
+    /// The surface uses the pixels in place, so it's read only (e.g. a source of SDL2::BlitSurface) and valid while the pixels are.
+    /// Pixels which aren't aligned to 4 bytes (the pack lies at any offset of the executable) are copied into a new surface instead.
+    /// @param pixels is the baked image, like *pack.Find("resources/image.png.pixels")
+    /// @return Returns the surface, or NULL on failure (not baked pixels).
+    SDL_Surface* SurfaceFromPixels(std::span<const char> pixels);
+
+    /// @brief Drains the event queue in batches with SDL2::PeepEvents into a reusable buffer and calls the handlers of the event types
+    /// from a dense table (pages of 256 types), instead of popping the events one by one and testing their types.
+    class EventPump {
+    public:
+        using Handler = std::function<void(const SDL_Event&)>;
+
+        /// @param batch_size is the count of the events taken from the queue at once
+        explicit EventPump(size_t batch_size = 128) : batch(batch_size) {}
+
+        /// @brief Sets the handler of an event type (like SDL_MOUSEMOTION), replacing the previous one.
+        void On(uint32_t type, Handler handler);
+
+        /// @brief Sets the handler of the events whose types have no handlers.
+        void OnOther(Handler handler) { other = std::move(handler); }
+
+        /// @brief Handles all the pending events.
+        /// @return The count of the handled events.
+        size_t Dispatch();
+
+        /// @brief Waits for an event up to the timeout in milliseconds (-1 - without a limit) and handles all the pending events.
+        /// @return The count of the handled events.
+        size_t Wait(int timeout);
+
+    private:
+        void Handle(const SDL_Event& event) const {
+            const Handler* page = pages[(event.type >> 8) & 0xFF].get();
+            const Handler& handler = page != nullptr and page[event.type & 0xFF] ? page[event.type & 0xFF] : other;
+            if (handler) handler(event);
+        }
+
+        std::vector<SDL_Event> batch;
+        std::unique_ptr<Handler[]> pages[256];
+        Handler other;
+    };
+
+    /// @brief Main loop which sleeps in SDL2::WaitEventTimeout while nothing happens, and redraws only when the content is marked dirty
+    /// or the frame deadline is reached (instead of redrawing as fast as possible). It's used by the thread it runs on only.
+    class RunLoop {
+    public:
+        /// @param frame_interval is the longest time between two redraws in milliseconds (0 - redraw only the dirty content)
+        explicit RunLoop(uint32_t frame_interval = 0) : frame_interval(frame_interval) {}
+
+        /// @brief Runs the loop until Stop is called. The content is dirty at the start, so it's drawn once at least.
+        /// @param on_event is called for every event (it calls Stop on SDL_QUIT for example)
+        /// @param on_draw is called to redraw the content
+        void Run(const std::function<void(const SDL_Event&)>& on_event, const std::function<void()>& on_draw);
+
+        /// @brief Runs the loop until Stop is called, the events are handled by the handlers of the pump.
+        void Run(EventPump& events, const std::function<void()>& on_draw);
+
+        /// @brief Requests a redraw as soon as the pending events are handled.
+        void MarkDirty() { dirty = true; }
+
+        /// @brief Stops the loop after the current event or frame.
+        void Stop() { running = false; }
+
+        /// @brief Returns the count of the drawn frames.
+        uint64_t Frames() const { return frames; }
+
+    private:
+        uint32_t frame_interval;
+        bool dirty = true;
+        bool running = false;
+        uint64_t frames = 0;
+    };
+
+    /// @brief Draws on a window surface and keeps the changed rectangles, so Present updates only them with SDL2::UpdateWindowSurfaceRects
+    /// (overlapping rectangles merged). If the changes cover too much of the window, the whole window is updated instead.
+    class DamageTracker {
+    public:
+        /// @param full_update_coverage is the part of the window (0 - 1) past which the whole window is updated
+        explicit DamageTracker(SDL_Window* window, float full_update_coverage = 0.5f) : window(window), full_update_coverage(full_update_coverage) {}
+
+        /// @brief Returns the window surface to draw on.
+        SDL_Surface* Surface() const;
+
+        /// @brief SDL2::BlitSurface to the window surface, the blitted rectangle is changed.
+        int BlitSurface(SDL_Surface* src, const SDL_Rect* srcrect, SDL_Rect* dstrect);
+
+        /// @brief SDL2::FillRect of the window surface, the filled rectangle is changed.
+        int FillRect(const SDL_Rect* rect, Uint32 color);
+
+        /// @brief Marks a rectangle as changed (drawn on the surface in another way).
+        void Damage(const SDL_Rect& rect);
+
+        /// @brief Marks the whole window as changed.
+        void DamageAll() { full_update = true; }
+
+        /// @brief Updates the changed rectangles of the window and forgets them.
+        /// @return 0 on success or a negative error code on failure (SDL2::GetError tells more).
+        int Present();
+
+    private:
+        SDL_Window* window;
+        float full_update_coverage;
+        std::vector<SDL_Rect> rectangles;
+        bool full_update = false;
+    };
+
+    /// @brief Defines if the startup trace is recorded. Set by the COSMO_SDL2_TRACE environment variable (the output file of the trace).
+    extern const bool trace_enabled;
+
+    /// @brief Span of the startup trace, recorded from its creation to its destruction. Does nothing if the trace isn't enabled.
+    class TraceSpan {
+    public:
+        /// @param name is the name of the span, must outlive it (a string literal for example)
+        /// @param detail is not necessary, additional info about the span (like a file name), must outlive it
+        explicit TraceSpan(const char* name, const char* detail = nullptr) : name(name), detail(detail), start(trace_enabled ? Now() : 0) {}
+        ~TraceSpan() { if (start != 0) Record(); }
+        TraceSpan(const TraceSpan&) = delete;
+        TraceSpan& operator=(const TraceSpan&) = delete;
+
+    private:
+        static int64_t Now();
+        void Record() const;
+
+        const char* name;
+        const char* detail;
+        int64_t start;
+    };
+
+    /// @brief Writes the recorded spans to the COSMO_SDL2_TRACE file as Chrome trace events (for chrome://tracing or ui.perfetto.dev).
+    /// Called by SDL2::Quit. Does nothing if the trace isn't enabled.
+    void WriteTrace();
+
     /* SDL2 functions */
 
 
 #if 1 // To hide the list
 
-    /// @brief Loads the SDL library (if not loaded yet) and initialize it. https://wiki.libsdl.org/SDL2/SDL_Init
+    /// @brief Loads the SDL library (if not loaded yet) and initialize it. The libraries requested with SDL2::Preload are loaded in parallel. https://wiki.libsdl.org/SDL2/SDL_Init
     /// @param flags subsystem initialization flags
     /// @param library_path is not necessary, define the path to the library (current by default)
     /// @return Zero on success or a negative error code on failure; call SDL_GetError() for more information.
@@ -3954,10 +4213,6 @@ namespace SDL2 {
     /// @return Returns the function pointer for vkGetInstanceProcAddr or NULL on error.
     void* Vulkan_GetVkGetInstanceProcAddr();
 
-    /// @brief Use this function to get the address of the ```vkGetInstanceProcAddr``` function. https://wiki.libsdl.org/SDL2/SDL_Vulkan_GetVkInstanceProcAddr
-    /// @return Returns a pointer to the vkGetInstanceProcAddr which can be used to load Vulkan function pointers at runtime.
-    void * SDL_Vulkan_GetVkGetInstanceProcAddr()Vulkan_GetVkInstanceProcAddr();
-
     /// @brief Dynamically load the Vulkan loader library. https://wiki.libsdl.org/SDL2/SDL_Vulkan_LoadLibrary
     /// @param path The platform dependent Vulkan loader library name or NULL
     /// @return Returns 0 on success or -1 if the library couldn't be loaded; call SDL_GetError() for more information.
@@ -5567,6 +5822,94 @@ namespace SDL2 {
 
 #endif
 
+    /// @brief Game loop with a fixed timestep. The simulation advances the state at a fixed tick rate on a worker thread, the calling
+    /// thread handles the events and draws the state interpolated between the last two ticks, so slow presents don't hold the
+    /// simulation or the input back. The ticks are published through a lock-free buffer (double buffered snapshots with a spare one,
+    /// so neither thread ever waits for the other).
+    /// @tparam State is the state of the simulation, it's copied into the snapshots
+    template <typename State>
+    class FixedStepLoop {
+    public:
+        /// @param ticks_per_second is the rate of the simulation
+        /// @param frames_per_second is the highest rate of drawing (0 - as fast as possible)
+        FixedStepLoop(uint32_t ticks_per_second, uint32_t frames_per_second, const State& initial)
+            : ticks_per_second(ticks_per_second), frames_per_second(frames_per_second), snapshots{ Snapshot{ initial, initial, 0 }, Snapshot{ initial, initial, 0 }, Snapshot{ initial, initial, 0 } } {}
+
+        /// @brief Runs the loop until Stop is called.
+        /// @param on_tick advances the state by one tick (of 1 / ticks_per_second seconds), called on the worker thread
+        /// @param on_event is called for every event on the calling thread (it calls Stop on SDL_QUIT for example)
+        /// @param on_draw draws the previous and the current state of the simulation mixed by alpha (0 - 1), on the calling thread
+        void Run(const std::function<void(State&, double)>& on_tick, const std::function<void(const SDL_Event&)>& on_event,
+            const std::function<void(const State&, const State&, double)>& on_draw) {
+            running = true;
+            const uint64_t frequency = GetPerformanceFrequency(), tick = frequency / ticks_per_second;
+            const uint64_t frame = frames_per_second != 0 ? frequency / frames_per_second : 0;
+            std::thread simulation([&] {
+                State state = snapshots[back].current;
+                uint64_t next = GetPerformanceCounter();
+                while (running) {
+                    uint64_t now = GetPerformanceCounter();
+                    if (now < next) {
+                        std::this_thread::sleep_for(std::chrono::nanoseconds((next - now) * 1000000000 / frequency));
+                        continue;
+                    }
+                    if (now - next > 8 * tick) next = now; // Far behind (a breakpoint, a suspended machine), the lost ticks are skipped
+                    Snapshot& snapshot = snapshots[back];
+                    snapshot.previous = state;
+                    on_tick(state, 1.0 / ticks_per_second);
+                    snapshot.current = state;
+                    snapshot.time = next;
+                    back = middle.exchange(back | fresh) & slot_mask;
+                    next += tick;
+                }
+            });
+            uint64_t next_frame = GetPerformanceCounter();
+            SDL_Event event;
+            while (running) {
+                uint64_t now = GetPerformanceCounter();
+                int timeout = now < next_frame ? static_cast<int>((next_frame - now) * 1000 / frequency) : 0;
+                if (WaitEventTimeout(&event, timeout) != 0) {
+                    do on_event(event);
+                    while (running and PollEvent(&event) != 0);
+                }
+                now = GetPerformanceCounter();
+                if (not running or now < next_frame) continue;
+                if (middle.load() & fresh) front = middle.exchange(front) & slot_mask;
+                const Snapshot& snapshot = snapshots[front];
+                // The drawn state is a tick behind: the previous state at the time of the tick, the current one a tick later
+                double alpha = now <= snapshot.time ? 0.0 : now - snapshot.time >= tick ? 1.0 : double(now - snapshot.time) / tick;
+                on_draw(snapshot.previous, snapshot.current, alpha);
+                frames++;
+                next_frame = now + frame;
+            }
+            simulation.join();
+        }
+
+        /// @brief Stops the loop after the current event, tick or frame. It can be called from any thread.
+        void Stop() { running = false; }
+
+        /// @brief Returns the count of the drawn frames.
+        uint64_t Frames() const { return frames; }
+
+    private:
+        struct Snapshot {
+            State previous;
+            State current;
+            uint64_t time; // Performance counter of the current state
+        };
+
+        static constexpr uint8_t slot_mask = 0x3, fresh = 0x4; // The spare slot index and if the simulation published it since the last frame
+
+        uint32_t ticks_per_second;
+        uint32_t frames_per_second;
+        Snapshot snapshots[3];
+        uint8_t back = 0; // Written by the simulation
+        std::atomic<uint8_t> middle = 1; // The spare one, exchanged by both threads
+        uint8_t front = 2; // Read by the drawing
+        std::atomic<bool> running = false;
+        uint64_t frames = 0;
+    };
+
 } // namespace SDL2
 
 #endif
\ No newline at end of file
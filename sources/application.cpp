@@ -8,23 +8,28 @@
 
 #include "cosmo_sdl2.hpp"
 
+/// @brief Loads an image of the asset pack in the format, from the baked pixels if there are ones (see baked_images in build.py).
+/// Logs the error if the image can't be loaded or converted, with what names the image in the message.
+SDL_Surface* LoadImage(const SDL2::AssetPack& resources, const std::string& name, const SDL_PixelFormat* format, const std::string& what) {
+  std::optional<std::span<const char>> pixels = resources.Find(name + ".pixels");
+  SDL_Surface* surface = pixels ? SDL2::SurfaceFromPixels(*pixels) : SDL2::Image::Load_RW(resources.RWFromAsset(name), 1);
+  if (surface == nullptr) {
+    LogError("Couldn't load the " + what + ": " + SDL2::GetError());
+    return nullptr;
+  }
+  if (surface->format->format == format->format) return surface;
+  SDL_Surface* converted = SDL2::ConvertSurface(surface, format, 0);
+  if (converted == nullptr) LogError("Couldn't convert the " + what + ": " + SDL2::GetError());
+  SDL2::FreeSurface(surface);
+  return converted;
+}
+
 int32_t main() {
   SDL2::SwitchLog(false);
-  if (IsWindows()) {
-    FreeConsole();
-    UnpackFile("libs/libgme.dll");
-    UnpackFile("libs/libogg-0.dll");
-    UnpackFile("libs/libopus-0.dll");
-    UnpackFile("libs/libopusfile-0.dll");
-    UnpackFile("libs/libwavpack-1.dll");
-    UnpackFile("libs/libxmp.dll");
-    UnpackFile("libs/libavif-16.dll");
-    UnpackFile("libs/libtiff-5.dll");
-    UnpackFile("libs/libwebp-7.dll");
-    UnpackFile("libs/libwebpdemux-2.dll");
-  }
-  UnpackFile("resources/image.png");
-  UnpackFile("resources/icon.ico");
+  SDL2::SwitchMemoryLoading(true);
+  SDL2::SwitchSharedCache(true);
+  if (IsWindows()) FreeConsole();
+  auto startup_span = std::make_unique<SDL2::TraceSpan>("Startup"); // Up to the first frame on the screen
   if (SDL2::Init(SDL_INIT_VIDEO, "libs/") != 0) {
     LogError(SDL2::IsLoaded() ? SDL2::GetError() : "Unexpected error.");
     return -1;
@@ -38,36 +43,23 @@ int32_t main() {
 		LogError(std::string("Couldn't initialize SDL image: ") + SDL2::GetError());
 		return -1;
 	}
+  SDL2::AssetPack resources("/zip/resources.pack");
   SDL_Surface* window_surface = SDL2::GetWindowSurface( window );
-  SDL_Surface* load_image_surface = SDL2::Image::Load("resources/image.png");
-  if (load_image_surface == nullptr) {
-    LogError(std::string("Couldn't load the image: ") + SDL2::GetError());
-    return -1;
-  }
-  SDL_Surface* image_surface = SDL2::ConvertSurface(load_image_surface, window_surface->format, 0);
-  if (image_surface == nullptr) {
-    LogError(std::string("Couldn't convert the image: ") + SDL2::GetError());
-    return -1;
-  }
-  SDL2::FreeSurface(load_image_surface);
-  load_image_surface = SDL2::Image::Load("resources/icon.ico");
-  if (load_image_surface == nullptr) {
-    LogError(std::string("Couldn't load the icon: ") + SDL2::GetError());
-    return -1;
-  }
-  SDL_Surface* icon_surface = SDL2::ConvertSurface(load_image_surface, window_surface->format, 0);
-  if (icon_surface == nullptr) {
-    LogError(std::string("Couldn't convert the icon: ") + SDL2::GetError());
-    return -1;
-  }
+  SDL_Surface* image_surface = LoadImage(resources, "resources/image.png", window_surface->format, "image");
+  if (image_surface == nullptr) return -1;
+  SDL_Surface* icon_surface = LoadImage(resources, "resources/icon.ico", window_surface->format, "icon");
+  if (icon_surface == nullptr) return -1;
   SDL2::SetWindowIcon(window, icon_surface);
-  bool run = true;
-  SDL_Event e;
-  while (run) {
-    while(SDL2::PollEvent(&e) != 0) if(e.type == SDL_QUIT) run = false;
-    SDL2::BlitSurface(image_surface, nullptr, window_surface, nullptr);
-    SDL2::UpdateWindowSurface(window);
-  }
+  SDL2::RunLoop loop; // The image is static, so it's drawn again only when the window needs it
+  SDL2::DamageTracker damage(window);
+  SDL2::EventPump events;
+  events.On(SDL_QUIT, [&loop](const SDL_Event&) { loop.Stop(); });
+  events.On(SDL_WINDOWEVENT, [&loop](const SDL_Event&) { loop.MarkDirty(); }); // Exposed, restored, resized
+  loop.Run(events, [&] {
+    damage.BlitSurface(image_surface, nullptr, nullptr);
+    damage.Present();
+    startup_span.reset();
+  });
 	SDL2::FreeSurface(image_surface);
 	SDL2::DestroyWindow(window);
 	SDL2::Image::Quit();
@@ -0,0 +1,25 @@
+#pragma once
+
+/* SDL2 functions used by the example application (see COSMO_SDL2_SUBSET in cosmo_sdl2.hpp) */
+
+#define COSMO_SDL2_USE_BlitSurface 1
+#define COSMO_SDL2_USE_ConvertSurface 1
+#define COSMO_SDL2_USE_CreateRGBSurfaceWithFormat 1
+#define COSMO_SDL2_USE_CreateRGBSurfaceWithFormatFrom 1
+#define COSMO_SDL2_USE_CreateWindow 1
+#define COSMO_SDL2_USE_DestroyWindow 1
+#define COSMO_SDL2_USE_FillRect 1
+#define COSMO_SDL2_USE_FreeSurface 1
+#define COSMO_SDL2_USE_GetError 1
+#define COSMO_SDL2_USE_GetTicks64 1
+#define COSMO_SDL2_USE_GetWindowSurface 1
+#define COSMO_SDL2_USE_PeepEvents 1
+#define COSMO_SDL2_USE_PumpEvents 1
+#define COSMO_SDL2_USE_RWFromConstMem 1
+#define COSMO_SDL2_USE_SetWindowIcon 1
+#define COSMO_SDL2_USE_UpdateWindowSurface 1
+#define COSMO_SDL2_USE_UpdateWindowSurfaceRects 1
+#define COSMO_SDL2_USE_WaitEventTimeout 1
+
+#define COSMO_SDL2_USE_IMGLoad_RW 1
+#define COSMO_SDL2_USE_IMGQuit 1
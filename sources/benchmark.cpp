@@ -0,0 +1,487 @@
+#define _COSMO_SOURCE
+
+#include <libc/isystem/algorithm>
+#include <libc/isystem/atomic>
+#include <libc/isystem/chrono>
+#include <libc/isystem/cmath>
+#include <libc/isystem/cstdlib>
+#include <libc/isystem/ctime>
+#include <libc/isystem/filesystem>
+#include <libc/isystem/fstream>
+#include <libc/isystem/iostream>
+#include <libc/isystem/string>
+#include <libc/isystem/thread>
+#include <libc/isystem/vector>
+#include <libc/dlopen/dlfcn.h>
+#include <libc/dce.h>
+
+#include "cosmo_sdl2.hpp"
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Prints the first (cold) and the median (warm) sample of a benchmark, the spread and the standard deviation of the samples.
+    void Report(const std::string& name, std::vector<double> samples, const std::string& unit = "us") {
+        double first = samples.front(), mean = 0, variance = 0;
+        for (double sample : samples) mean += sample / samples.size();
+        for (double sample : samples) variance += (sample - mean) * (sample - mean) / samples.size();
+        std::sort(samples.begin(), samples.end());
+        std::cout << name << ": first " << first << " " << unit << ", median " << samples[samples.size() / 2]
+            << " " << unit << ", min " << samples.front() << " " << unit << ", max " << samples.back() << " " << unit
+            << ", stddev " << std::sqrt(variance) << " " << unit << " (" << samples.size() << " runs)\n";
+    }
+
+    /// @brief Removes the symbol caches of the libraries folder (one per function manifest).
+    void RemoveSymbolCache() {
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator("libs", error))
+            if (entry.path().extension() == ".symbols") std::filesystem::remove(entry.path(), error);
+    }
+
+    /// @brief Measures the time from loading the libraries up to an initialized SDL video subsystem.
+    /// @param eager defines if all the functions are bound at once (as before) or lazily on their first calls
+    /// @param symbol_cache defines if the symbol offsets saved by the previous run are used (otherwise the cache file is removed before each run)
+    std::vector<double> StartupSamples(bool eager, int32_t runs, bool symbol_cache = true) {
+        std::vector<double> samples;
+        for (int32_t i = 0; i < runs; i++) {
+            if (not symbol_cache) RemoveSymbolCache();
+            auto start = Clock::now();
+            if (not SDL2::LoadSDLLibrary("libs/")) std::exit(-1);
+            if (eager) SDL2::BindAllFunctions(); // Older libraries may miss some functions, only the lookup time matters here
+            if (SDL2::Init(SDL_INIT_VIDEO, "libs/") != 0) std::exit(-1);
+            samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            SDL2::Quit();
+        }
+        return samples;
+    }
+
+    /// @brief Measures looking up all the functions in the already opened libraries.
+    /// @param symbol_cache defines if the symbol offsets saved by the previous run are used (otherwise the cache file is removed before each run)
+    std::vector<double> BindSamples(bool symbol_cache, int32_t runs) {
+        std::vector<double> samples;
+        for (int32_t i = 0; i < runs; i++) {
+            if (not symbol_cache) RemoveSymbolCache();
+            if (SDL2::Init(0, "libs/") != 0) std::exit(-1);
+            SDL2::Net::Init();
+            SDL2::Mixer::Init(0);
+            SDL2::TTF::Init();
+            SDL2::Image::Init(0);
+            auto start = Clock::now();
+            SDL2::BindAllFunctions();
+            samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            SDL2::Quit();
+        }
+        return samples;
+    }
+
+    /// @brief Measures the time up to an initialized SDL video subsystem with every satellite library loaded and bound.
+    /// @param parallel defines if the satellite libraries are preloaded on worker threads during SDL2::Init or after it on the main thread
+    std::vector<double> PreloadSamples(bool parallel, int32_t runs) {
+        std::vector<double> samples;
+        for (int32_t i = 0; i < runs; i++) {
+            auto start = Clock::now();
+            SDL2::Preload(parallel ? SDL2::LIB_NET | SDL2::LIB_MIXER | SDL2::LIB_TTF | SDL2::LIB_IMAGE : 0);
+            if (SDL2::Init(SDL_INIT_VIDEO, "libs/") != 0) std::exit(-1);
+            if (not parallel) SDL2::BindAllFunctions();
+            samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            SDL2::Quit();
+        }
+        SDL2::Preload(0);
+        return samples;
+    }
+
+    using AtomicGetProto = int (*)(SDL_atomic_t *a);
+    using AtomicGetProto_WIN = __attribute__((__ms_abi__)) AtomicGetProto;
+
+    static void* raw_atomic_get = nullptr;
+
+    /// @brief The way every wrapper called SDL before the dispatch table: the ABI is checked on each call.
+    __attribute__((__noinline__)) int LegacyAtomicGet(SDL_atomic_t *a) {
+        if (IsWindows()) return (reinterpret_cast<AtomicGetProto_WIN>(raw_atomic_get))(a);
+        return (reinterpret_cast<AtomicGetProto>(raw_atomic_get))(a);
+    }
+
+    /// @brief Looks a function up in SDL2 directly, past the SDL2:: wrappers (SDL2 must be loaded by SDL2::Init already).
+    void* RawSymbol(const char* name) {
+        static void* library = cosmo_dlopen(IsWindows() ? "libs/SDL2.dll" : "libs/libSDL2.so", RTLD_LAZY);
+        if (library == nullptr) library = cosmo_dlopen(IsWindows() ? "SDL2.dll" : "libSDL2.so", RTLD_LAZY);
+        void* address = library != nullptr ? cosmo_dlsym(library, name) : nullptr;
+        if (address == nullptr) std::exit(-1);
+        return address;
+    }
+
+    /// @brief Keeps a result of a benchmarked call, so the call isn't optimized out.
+    template <typename T> void Keep(T value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /// @brief Measures the time of one call in nanoseconds (average of a batch of calls per sample).
+    template <typename Call> std::vector<double> CallSamples(Call call, int32_t runs, int32_t batch = 1000000) {
+        std::vector<double> samples;
+        for (int32_t i = 0; i < runs; i++) {
+            auto start = Clock::now();
+            for (int32_t j = 0; j < batch; j++) Keep(call());
+            samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / batch);
+        }
+        return samples;
+    }
+
+    /// @brief Raw SDL function type, with its Microsoft ABI variant for Windows.
+    template <typename Proto> struct RawFunction;
+
+    template <typename Result, typename... Args> struct RawFunction<Result (*)(Args...)> {
+        using Proto = Result (*)(Args...);
+        using Proto_WIN = __attribute__((__ms_abi__)) Proto;
+    };
+
+    /// @brief Reports the cost of a SDL2:: wrapper and of the raw SDL function it calls, with the same arguments.
+    /// The ABI of the raw function is chosen before the measuring, so it's the bare cost of a SDL call.
+    template <auto wrapper, typename... Values>
+    void CompareWithRaw(const std::string& name, const char* symbol, int32_t runs, int32_t batch, Values... values) {
+        using Raw = RawFunction<decltype(wrapper)>;
+        void* address = RawSymbol(symbol);
+        Report(name + ", SDL2:: wrapper", CallSamples([=] { return wrapper(values...); }, runs, batch), "ns");
+        if (IsWindows()) {
+            auto raw = reinterpret_cast<typename Raw::Proto_WIN>(address);
+            Report(name + ", raw SDL", CallSamples([=] { return raw(values...); }, runs, batch), "ns");
+        }
+        else {
+            auto raw = reinterpret_cast<typename Raw::Proto>(address);
+            Report(name + ", raw SDL", CallSamples([=] { return raw(values...); }, runs, batch), "ns");
+        }
+    }
+
+    /// @brief Compares the per-call overhead of a wrapper with the legacy ABI check and with calling SDL directly.
+    void CallOverhead(int32_t runs) {
+        if (SDL2::Init(0, "libs/") != 0) std::exit(-1);
+        raw_atomic_get = RawSymbol("SDL_AtomicGet");
+        SDL_atomic_t atomic { 0 };
+        SDL_atomic_t* a = &atomic;
+        Report("AtomicGet, SDL2:: wrapper", CallSamples([a] { return SDL2::AtomicGet(a); }, runs), "ns");
+        Report("AtomicGet, legacy ABI check", CallSamples([a] { return LegacyAtomicGet(a); }, runs), "ns");
+        if (not IsWindows()) {
+            AtomicGetProto direct = reinterpret_cast<AtomicGetProto>(raw_atomic_get);
+            Report("AtomicGet, direct", CallSamples([direct, a] { return direct(a); }, runs), "ns");
+        }
+        SDL2::Quit();
+    }
+
+    /// @brief Measures the first calls of unbound functions made by several threads at once, and checks that every thread got
+    /// the results of the real functions (the threads bind the same functions and patch the same table concurrently).
+    void ConcurrentBinding(int32_t runs) {
+        const int32_t threads = std::max(4u, std::thread::hardware_concurrency());
+        std::vector<double> samples;
+        for (int32_t i = 0; i < runs; i++) {
+            if (SDL2::Init(0, "libs/") != 0) std::exit(-1);
+            SDL_atomic_t counter { 0 };
+            std::atomic<int32_t> ready = 0, failures = 0;
+            std::vector<std::thread> workers;
+            auto start = Clock::now();
+            for (int32_t j = 0; j < threads; j++) {
+                workers.emplace_back([&] {
+                    for (ready++; ready < threads;) {} // All the threads make their first calls at the same moment
+                    SDL2::AtomicAdd(&counter, 1);
+                    if (SDL2::GetCPUCount() < 1 or SDL2::GetSystemRAM() < 1 or SDL2::GetPlatform() == nullptr
+                        or SDL2::GetPerformanceCounter() == 0) failures++;
+                });
+            }
+            for (std::thread& worker : workers) worker.join();
+            samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            if (failures != 0 or SDL2::AtomicGet(&counter) != threads) {
+                std::cout << "concurrent binding: wrong results of the first calls\n";
+                std::exit(-1);
+            }
+            SDL2::Quit();
+        }
+        Report("first calls from " + std::to_string(threads) + " threads at once", samples);
+    }
+
+    /// @brief Compares representative SDL2:: wrappers with the raw SDL functions, to catch regressions of the dispatch path.
+    void WrapperOverhead(int32_t runs) {
+        if (SDL2::Init(SDL_INIT_VIDEO, "libs/") != 0) std::exit(-1);
+        SDL_atomic_t atomic { 0 };
+        SDL_Surface* source = SDL2::CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+        SDL_Surface* target = SDL2::CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+        if (source == nullptr or target == nullptr) std::exit(-1);
+        SDL_Event event;
+        while (SDL2::PollEvent(&event) != 0) {} // The queue must be empty
+        CompareWithRaw<SDL2::GetTicks>("GetTicks", "SDL_GetTicks", runs, 1000000);
+        CompareWithRaw<SDL2::AtomicAdd>("AtomicAdd", "SDL_AtomicAdd", runs, 1000000, &atomic, 1);
+        CompareWithRaw<SDL2::FillRect>("FillRect 16x16", "SDL_FillRect", runs, 100000, target, static_cast<const SDL_Rect*>(nullptr), Uint32(0xff00ff00));
+        CompareWithRaw<SDL2::BlitSurface>("BlitSurface 16x16", "SDL_UpperBlit", runs, 100000,
+            source, static_cast<const SDL_Rect*>(nullptr), target, static_cast<SDL_Rect*>(nullptr));
+        CompareWithRaw<SDL2::PollEvent>("PollEvent, empty queue", "SDL_PollEvent", runs, 100000, &event);
+        SDL2::FreeSurface(source);
+        SDL2::FreeSurface(target);
+        SDL2::Quit();
+    }
+
+    /// @brief The way UnpackFile copied before: one character at a time through the stream iterators.
+    bool LegacyUnpackFile(const std::string& filename) {
+        std::ifstream input("/zip/" + filename, std::ios::binary);
+        std::ofstream output(filename, std::ios::binary);
+        if (not input.is_open() or not output.is_open()) return false;
+        std::copy(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>(), std::ostreambuf_iterator<char>(output));
+        return true;
+    }
+
+    /// @brief Measures the throughput (MB/s) of unpacking the packed libs/ folder. The files are removed before each run, so all of them are written.
+    void UnpackThroughput(int32_t runs) {
+        std::vector<std::string> files;
+        uint64_t bytes = 0;
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator("/zip/libs", error)) {
+            files.push_back("libs/" + entry.path().filename().string());
+            bytes += entry.file_size();
+        }
+        if (files.empty()) {
+            std::cout << "unpacking: there is no packed libs/ folder\n";
+            return;
+        }
+        auto samples = [&](auto unpack) {
+            std::vector<double> samples;
+            for (int32_t i = 0; i < runs; i++) {
+                for (const std::string& file : files) std::filesystem::remove(file, error);
+                auto start = Clock::now();
+                if (not unpack()) std::exit(-1);
+                samples.push_back(bytes / std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            }
+            return samples;
+        };
+        auto each = [&](bool (*unpack)(const std::string&)) {
+            return [&files, unpack] { return std::all_of(files.begin(), files.end(), unpack); };
+        };
+        auto unpack_file = each([](const std::string& file) { return UnpackFile(file, false); });
+        std::cout << "unpacking " << files.size() << " files, " << bytes << " bytes\n";
+        Report("unpacking, UnpackFile", samples(unpack_file), "MB/s");
+        Report("unpacking, UnpackFiles (parallel)", samples([&files] {
+            std::vector<bool> unpacked = UnpackFiles(files, false);
+            return std::find(unpacked.begin(), unpacked.end(), false) == unpacked.end();
+        }), "MB/s");
+        Report("unpacking, stream iterators", samples(each(LegacyUnpackFile)), "MB/s");
+        samples(unpack_file); // Leave the libraries unpacked by UnpackFile
+    }
+
+    /// @brief Measures the CPU time of showing a static image for a few seconds: redrawing as fast as possible (as the example did)
+    /// and with SDL2::RunLoop, which redraws by a 250 ms deadline here and sleeps in between.
+    void IdleCPU() {
+        constexpr auto duration = std::chrono::seconds(5);
+        if (SDL2::Init(SDL_INIT_VIDEO, "libs/") != 0) std::exit(-1);
+        SDL_Window* window = SDL2::CreateWindow("sdlbench", 0, 0, 600, 600, SDL_WINDOW_SHOWN);
+        SDL_Surface* window_surface = window != nullptr ? SDL2::GetWindowSurface(window) : nullptr;
+        if (window_surface == nullptr) std::exit(-1);
+        SDL_Surface* image = SDL2::CreateRGBSurfaceWithFormat(0, 600, 600, 32, window_surface->format->format);
+        auto draw = [&] {
+            SDL2::BlitSurface(image, nullptr, window_surface, nullptr);
+            SDL2::UpdateWindowSurface(window);
+        };
+        auto measure = [&](const std::string& name, auto loop) {
+            std::clock_t cpu = std::clock();
+            auto start = Clock::now();
+            uint64_t frames = loop(start + duration);
+            double minutes = std::chrono::duration<double, std::ratio<60>>(Clock::now() - start).count();
+            std::cout << name << ": " << (std::clock() - cpu) * 1000.0 / CLOCKS_PER_SEC / minutes << " ms of CPU time per minute, "
+                << frames / minutes / 60 << " frames/s\n";
+        };
+        measure("idle, redrawing continuously", [&](Clock::time_point end) {
+            uint64_t frames = 0;
+            SDL_Event event;
+            for (; Clock::now() < end; frames++) {
+                while (SDL2::PollEvent(&event) != 0) {}
+                draw();
+            }
+            return frames;
+        });
+        measure("idle, SDL2::RunLoop", [&](Clock::time_point end) {
+            SDL2::RunLoop loop(250);
+            loop.Run([](const SDL_Event&) {}, [&] {
+                if (Clock::now() >= end) loop.Stop();
+                draw();
+            });
+            return loop.Frames();
+        });
+        SDL2::FreeSurface(image);
+        SDL2::DestroyWindow(window);
+        SDL2::Quit();
+    }
+
+    /// @brief Measures frames of a 32x32 sprite moving over a 600x600 background: redrawing and updating the whole window
+    /// and with SDL2::DamageTracker (restoring the background under the sprite and updating the changed rectangles only).
+    void DamageFrames(int32_t runs) {
+        constexpr int32_t frames = 1000;
+        if (SDL2::Init(SDL_INIT_VIDEO, "libs/") != 0) std::exit(-1);
+        SDL_Window* window = SDL2::CreateWindow("sdlbench", 0, 0, 600, 600, SDL_WINDOW_SHOWN);
+        SDL_Surface* window_surface = window != nullptr ? SDL2::GetWindowSurface(window) : nullptr;
+        if (window_surface == nullptr) std::exit(-1);
+        SDL_Surface* background = SDL2::CreateRGBSurfaceWithFormat(0, 600, 600, 32, window_surface->format->format);
+        SDL_Surface* sprite = SDL2::CreateRGBSurfaceWithFormat(0, 32, 32, 32, window_surface->format->format);
+        SDL2::FillRect(background, nullptr, 0x203040);
+        SDL2::FillRect(sprite, nullptr, 0xFFFFFF);
+        auto position = [](int32_t frame) { return SDL_Rect{ frame * 7 % 568, frame * 3 % 568, 32, 32 }; };
+        auto samples = [&](auto draw) {
+            std::vector<double> samples;
+            for (int32_t i = 0; i < runs; i++) {
+                auto start = Clock::now();
+                for (int32_t frame = 0; frame < frames; frame++) draw(frame);
+                samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count() / frames);
+            }
+            return samples;
+        };
+        Report("moving sprite, full window updates", samples([&](int32_t frame) {
+            SDL_Rect rect = position(frame);
+            SDL2::BlitSurface(background, nullptr, window_surface, nullptr);
+            SDL2::BlitSurface(sprite, nullptr, window_surface, &rect);
+            SDL2::UpdateWindowSurface(window);
+        }), "us/frame");
+        SDL2::DamageTracker damage(window);
+        damage.BlitSurface(background, nullptr, nullptr);
+        damage.Present();
+        Report("moving sprite, SDL2::DamageTracker", samples([&](int32_t frame) {
+            SDL_Rect previous = position(frame == 0 ? frames - 1 : frame - 1), rect = position(frame);
+            SDL_Rect under = previous;
+            damage.BlitSurface(background, &previous, &under);
+            damage.BlitSurface(sprite, nullptr, &rect);
+            damage.Present();
+        }), "us/frame");
+        SDL2::FreeSurface(sprite);
+        SDL2::FreeSurface(background);
+        SDL2::DestroyWindow(window);
+        SDL2::Quit();
+    }
+
+    /// @brief Runs the pipeline of the example without a display (SDL_VIDEODRIVER=dummy by default, or offscreen): loads the image
+    /// from resources.pack (baked pixels or decoded), converts it to the window format, then blits and presents it for the frames.
+    void FramePipeline(int32_t frames) {
+        auto start = Clock::now();
+        if (SDL2::Init(SDL_INIT_VIDEO, "libs/") != 0) std::exit(-1);
+        SDL_Window* window = SDL2::CreateWindow("sdlbench", 0, 0, 600, 600, SDL_WINDOW_SHOWN);
+        SDL_Surface* window_surface = window != nullptr ? SDL2::GetWindowSurface(window) : nullptr;
+        if (window_surface == nullptr) std::exit(-1);
+        SDL2::AssetPack resources("/zip/resources.pack");
+        std::optional<std::span<const char>> pixels = resources.Find("resources/image.png.pixels");
+        SDL_Surface* loaded = pixels ? SDL2::SurfaceFromPixels(*pixels) : nullptr;
+        if (loaded == nullptr and resources.Find("resources/image.png") and SDL2::Image::Init(IMG_INIT_PNG) == IMG_INIT_PNG)
+            loaded = SDL2::Image::Load_RW(resources.RWFromAsset("resources/image.png"), 1);
+        if (loaded == nullptr) {
+            std::cout << "frames: there is no resources/image.png in the packed resources.pack\n";
+            SDL2::Quit();
+            return;
+        }
+        SDL_Surface* image = SDL2::ConvertSurface(loaded, window_surface->format, 0);
+        SDL2::FreeSurface(loaded);
+        if (image == nullptr) std::exit(-1);
+        std::vector<double> frame_times;
+        for (int32_t frame = 0; frame <= frames; frame++) { // The first frame is the time to the first frame, not counted
+            auto frame_start = Clock::now();
+            SDL2::BlitSurface(image, nullptr, window_surface, nullptr);
+            SDL2::UpdateWindowSurface(window);
+            frame_times.push_back(std::chrono::duration<double, std::micro>(Clock::now() - (frame == 0 ? start : frame_start)).count());
+        }
+        double first_frame = frame_times.front(), total = 0;
+        frame_times.erase(frame_times.begin());
+        for (double time : frame_times) total += time;
+        std::sort(frame_times.begin(), frame_times.end());
+        auto percentile = [&](double part) { return frame_times[std::min(frame_times.size() - 1, size_t(frame_times.size() * part))]; };
+        std::cout << "frames (" << (pixels ? "baked pixels" : "decoded image") << "): " << frame_times.size() << " frames, "
+            << frame_times.size() / total * 1e6 << " frames/s, p50 " << percentile(0.5) << " us, p99 " << percentile(0.99)
+            << " us, time to first frame " << first_frame << " us\n";
+        SDL2::FreeSurface(image);
+        SDL2::DestroyWindow(window);
+        SDL2::Image::Quit();
+        SDL2::Quit();
+    }
+
+    /// @brief Runs SDL2::FixedStepLoop at 120 ticks per second for 2 seconds with presents taking 25 ms (a slow compositor),
+    /// and measures the intervals between the ticks: the simulation keeps its rate while the drawing is slow.
+    void FixedStep() {
+        constexpr uint32_t ticks_per_second = 120;
+        if (SDL2::Init(SDL_INIT_VIDEO, "libs/") != 0) std::exit(-1);
+        struct State {
+            uint64_t ticks;
+            double x;
+        };
+        std::vector<double> intervals;
+        auto last_tick = Clock::now(), end = last_tick + std::chrono::seconds(2);
+        SDL2::FixedStepLoop<State> loop(ticks_per_second, 0, State{ 0, 0 });
+        loop.Run([&](State& state, double seconds) {
+            auto now = Clock::now();
+            if (state.ticks++ > 0) intervals.push_back(std::chrono::duration<double, std::milli>(now - last_tick).count());
+            last_tick = now;
+            state.x += 100 * seconds;
+        }, [](const SDL_Event&) {}, [&](const State&, const State&, double) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(25));
+            if (Clock::now() >= end) loop.Stop();
+        });
+        std::sort(intervals.begin(), intervals.end());
+        std::cout << "fixed step, 25 ms presents: " << intervals.size() + 1 << " ticks (" << ticks_per_second << " per second), " << loop.Frames()
+            << " frames, tick interval p50 " << intervals[intervals.size() / 2] << " ms, p99 " << intervals[intervals.size() * 99 / 100] << " ms\n";
+        SDL2::Quit();
+    }
+
+    /// @brief Measures handling a burst of mouse motion events: popped one by one with SDL2::PollEvent and tested in an if-chain
+    /// (as the example did) and drained in batches by SDL2::EventPump.
+    void EventDispatch(int32_t runs) {
+        constexpr int32_t events = 10000;
+        if (SDL2::Init(SDL_INIT_EVENTS, "libs/") != 0) std::exit(-1);
+        uint64_t handled = 0;
+        auto samples = [&](auto drain) {
+            std::vector<double> samples;
+            for (int32_t i = 0; i < runs; i++) {
+                SDL_Event event{};
+                for (int32_t j = 0; j < events; j++) {
+                    event.type = j % 16 == 0 ? SDL_KEYDOWN : SDL_MOUSEMOTION;
+                    SDL2::PushEvent(&event);
+                }
+                auto start = Clock::now();
+                drain();
+                samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / events);
+            }
+            return samples;
+        };
+        Report("events, PollEvent and if-chain", samples([&] {
+            SDL_Event event;
+            while (SDL2::PollEvent(&event) != 0) {
+                if (event.type == SDL_QUIT) handled += 3;
+                else if (event.type == SDL_WINDOWEVENT) handled += 2;
+                else if (event.type == SDL_KEYDOWN) handled += 1;
+                else if (event.type == SDL_MOUSEMOTION) handled += 1;
+            }
+        }), "ns/event");
+        SDL2::EventPump pump;
+        pump.On(SDL_QUIT, [&](const SDL_Event&) { handled += 3; });
+        pump.On(SDL_WINDOWEVENT, [&](const SDL_Event&) { handled += 2; });
+        pump.On(SDL_KEYDOWN, [&](const SDL_Event&) { handled += 1; });
+        pump.On(SDL_MOUSEMOTION, [&](const SDL_Event&) { handled += 1; });
+        Report("events, SDL2::EventPump", samples([&] { pump.Dispatch(); }), "ns/event");
+        if (handled != 2ull * runs * events) std::cout << "events: some events were lost\n";
+        SDL2::Quit();
+    }
+
+} // namespace
+
+/// Usage: sdlbench.exe [startup-eager|startup-eager-nocache|startup-lazy|bind|bind-nocache|startup-sequential|startup-parallel|bind-threads|calls|wrappers|unpack|idle|damage|frames|fixed-step|events] [runs]
+/// Run each mode in a fresh process to see the cold start, the first sample of each mode is reported separately.
+int32_t main(int32_t argc, char** argv) {
+    std::string mode = argc > 1 ? argv[1] : "all";
+    int32_t runs = argc > 2 ? std::max(1, std::atoi(argv[2])) : 20;
+    SDL2::SwitchLog(false);
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    if (mode == "all" or mode == "startup-lazy") Report("startup, lazy binding", StartupSamples(false, runs));
+    if (mode == "all" or mode == "startup-eager") Report("startup, eager binding", StartupSamples(true, runs));
+    if (mode == "all" or mode == "startup-eager-nocache") Report("startup, eager binding without symbol cache", StartupSamples(true, runs, false));
+    if (mode == "all" or mode == "bind") Report("binding all functions, symbol cache", BindSamples(true, runs));
+    if (mode == "all" or mode == "bind-nocache") Report("binding all functions, dlsym", BindSamples(false, runs));
+    if (mode == "all" or mode == "startup-sequential") Report("startup, all libraries, sequential", PreloadSamples(false, runs));
+    if (mode == "all" or mode == "startup-parallel") Report("startup, all libraries, parallel", PreloadSamples(true, runs));
+    if (mode == "all" or mode == "bind-threads") ConcurrentBinding(runs);
+    if (mode == "all" or mode == "calls") CallOverhead(runs);
+    if (mode == "all" or mode == "wrappers") WrapperOverhead(runs);
+    if (mode == "all" or mode == "unpack") UnpackThroughput(runs);
+    if (mode == "all" or mode == "idle") IdleCPU();
+    if (mode == "all" or mode == "damage") DamageFrames(runs);
+    if (mode == "all" or mode == "frames") FramePipeline(argc > 2 ? runs : 1000); // The count of the frames
+    if (mode == "all" or mode == "fixed-step") FixedStep();
+    if (mode == "all" or mode == "events") EventDispatch(runs);
+    return 0;
+}